@@ -236,6 +236,20 @@ public:
    */
   void updateErrorVectors();
 
+  /**
+   * Resize and zero the ErrorVectors, so that they can be filled with the local indicator values
+   * while the indicators are computed instead of in a separate pass over the mesh.
+   * sumErrorVectors() must be called once they have been filled.
+   *
+   * @return The ErrorVectors, by indicator field name
+   */
+  const std::map<std::string, std::unique_ptr<ErrorVector>> & resetErrorVectors();
+
+  /**
+   * Sum the local contributions to the ErrorVectors across all processors
+   */
+  void sumErrorVectors();
+
   /**
    * Query if an adaptivity step should be performed at the current time / time step
    */
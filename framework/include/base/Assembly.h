@@ -570,6 +570,15 @@ public:
   void addJacobianScalar();
   void addJacobianOffDiagScalar(unsigned int ivar);
 
+  /**
+   * Multiplies the element Jacobian blocks that are currently in _sub_Kee by the vector x and adds
+   * the product to y, instead of adding the blocks to a matrix.
+   * @param x The vector to multiply, it must be ghosted for the element's dofs
+   * @param y The vector the product is added to
+   * @param tag The matrix tag of the blocks
+   */
+  void addJacobianAction(const NumericVector<Number> & x, NumericVector<Number> & y, TagID tag);
+
   /**
    * Takes the values that are currently in _sub_Kee and appends them to the cached values.
    */
@@ -931,6 +940,15 @@ public:
    */
   void addCachedJacobianContributions();
 
+  /**
+   * Sets the rows of y that have previously-cached Jacobian values to the product of those values
+   * with x. This is the matrix-free counterpart of setCachedJacobianContributions(), y must be
+   * closed before it is called.
+   */
+  void setCachedJacobianContributionsAction(const NumericVector<Number> & x,
+                                            NumericVector<Number> & y,
+                                            TagID tag);
+
   /**
    * Set the pointer to the XFEM controller object
    */
@@ -1193,6 +1211,10 @@ protected:
   /// auxiliary matrix for scaling jacobians (optimization to avoid expensive construction/destruction)
   DenseMatrix<Number> _tmp_Ke;
 
+  /// auxiliary vectors for the element Jacobian action, the local values of x and the product
+  DenseVector<Number> _tmp_action_x;
+  DenseVector<Number> _tmp_action_y;
+
   // Shape function values, gradients. second derivatives
   VariablePhiValue _phi;
   VariablePhiGradient _grad_phi;
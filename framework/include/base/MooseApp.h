@@ -38,6 +38,7 @@ class InputParameterWarehouse;
 class SystemInfo;
 class CommandLine;
 class RelationshipManager;
+class SharedDataStore;
 
 template <>
 InputParameters validParams<MooseApp>();
@@ -452,6 +453,11 @@ public:
    */
   InputParameterWarehouse & getInputParameterWarehouse();
 
+  /**
+   * Get the store for large read-only data that is held once per node
+   */
+  SharedDataStore & getSharedDataStore();
+
   /*
    * Register a piece of restartable data.  This is data that will get
    * written / read to / from a restart file.
@@ -754,6 +760,9 @@ protected:
   /// The library, registration method and the handle to the method
   std::map<std::pair<std::string, std::string>, void *> _lib_handles;
 
+  /// Large read-only data held once per node, created on first use
+  std::unique_ptr<SharedDataStore> _shared_data_store;
+
 private:
   /** Method for creating the minimum required actions for an application (no input file)
    *
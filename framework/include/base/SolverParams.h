@@ -21,6 +21,10 @@ public:
   Moose::LineSearchType _line_search;
   Moose::MffdType _mffd_type;
 
+  /// Whether the Jacobian action of JFNK and PJFNK is computed element by element instead of by
+  /// finite differencing the residual
+  bool _element_jacobian_action;
+
   // solver parameters for eigenvalue problems
   Moose::EigenSolveType _eigen_solve_type;
   Moose::EigenProblemType _eigen_problem_type;
@@ -62,6 +62,17 @@ private:
   /// the grid
   std::vector<std::vector<Real>> _grid;
 
+  /// the point being sampled, in the grid reference frame
+  std::vector<Real> _pt_in_grid;
+
+  ///@{ the grid indices of the hypercube containing the last sampled point, see sample
+  std::vector<unsigned int> _left;
+  std::vector<unsigned int> _right;
+  ///@}
+
+  /// the grid indices of a vertex of the hypercube
+  std::vector<unsigned int> _arg;
+
   /**
    * This does the core work.  Given a point, pt, defined
    * on the grid (not the MOOSE simulation reference frame),
@@ -74,13 +85,14 @@ private:
    * Finds lower_x and upper_x which satisfy in_arr[lower_x] < x <= in_arr[upper_x].
    * End conditions: if x<in_arr[0] then lower_x = 0 = upper_x is returned
    *                 if x>in_arr[N-1] then lower_x = N-1 = upper_x is returned (N=size of in_arr)
+   * The interval starting at the passed in lower_x is checked before searching in_arr.
    *
    * @param in_arr The monotonically increasing vector of real numbers
    * @param x The real value for which we want the neighbor indices
-   * @param lower_x Upon return will contain lower_x specified above
+   * @param lower_x The hint, upon return will contain lower_x specified above
    * @param upper_x Upon return will contain upper_x specified above
    */
-  void getNeighborIndices(std::vector<Real> in_arr,
+  void getNeighborIndices(const std::vector<Real> & in_arr,
                           Real x,
                           unsigned int & lower_x,
                           unsigned int & upper_x);
@@ -108,6 +108,11 @@ public:
   Point _incremental_slip_prev_iter;
   bool _slip_reversed;
   Real _slip_tol;
+
+  /// Positions of the slave node followed by the nodes of _side when this information was last
+  /// computed; empty if it must be recomputed at the next update (see
+  /// PenetrationLocator::setSearchMotionTolerance)
+  std::vector<Point> _search_points;
 };
 
 // Used for Restart
@@ -88,6 +88,16 @@ public:
   void setNormalSmoothingMethod(std::string nsmString);
   Real getTangentialTolerance() { return _tangential_tolerance; }
 
+  /**
+   * Enables incremental updates of the penetration information. The information for a slave node
+   * is reused without a new projection while the slave node and the nodes of the master face that
+   * it was projected onto have all moved less than this distance since it was computed. Beyond
+   * that, the node is re-projected onto that face and a full search is performed if it no longer
+   * lies on the face. Zero (the default) recomputes the information at every update.
+   */
+  void setSearchMotionTolerance(Real tolerance);
+  Real getSearchMotionTolerance() { return _search_motion_tolerance; }
+
 protected:
   /// Check whether found candidates are reasonable
   bool _check_whether_reasonable;
@@ -98,6 +108,10 @@ protected:
   Real _normal_smoothing_distance; // Distance from edge (in parametric coords) within which to
                                    // perform normal smoothing
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
+  Real _search_motion_tolerance; // Motion below which penetration information is reused
+
+  /// The (elem, side, id) tuples of all boundary sides, cached between updates
+  std::vector<std::tuple<dof_id_type, unsigned short int, boundary_id_type>> _bc_tuples;
 
   const Moose::PatchUpdateType _patch_update_strategy; // Contact patch update strategy
 
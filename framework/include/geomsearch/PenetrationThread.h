@@ -32,6 +32,7 @@ public:
       bool check_whether_reasonable,
       bool update_location,
       Real tangential_tolerance,
+      Real search_motion_tolerance,
       bool do_normal_smoothing,
       Real normal_smoothing_distance,
       PenetrationLocator::NORMAL_SMOOTHING_METHOD normal_smoothing_method,
@@ -64,6 +65,7 @@ protected:
   bool _check_whether_reasonable;
   bool _update_location;
   Real _tangential_tolerance;
+  Real _search_motion_tolerance;
   bool _do_normal_smoothing;
   Real _normal_smoothing_distance;
   PenetrationLocator::NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
@@ -160,6 +162,16 @@ protected:
 
   void switchInfo(PenetrationInfo *& info, PenetrationInfo *& infoNew);
 
+  /**
+   * Whether the slave node and the nodes of the master face have all moved less than the
+   * search motion tolerance since the penetration information was computed, in which case
+   * the information is reused without a new projection
+   */
+  bool withinSearchMotionTolerance(const PenetrationInfo & info, const Node & node) const;
+
+  /// Records the positions used by withinSearchMotionTolerance()
+  void recordSearchPoints(PenetrationInfo & info, const Node & node) const;
+
   struct RidgeData
   {
     unsigned int _index;
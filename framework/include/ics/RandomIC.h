@@ -48,6 +48,17 @@ protected:
   Real _min;
   Real _max;
   Real _range;
+
+  /// Whether or not the values are computed by the counter-based generator
+  const bool _counter_based;
+
+  /// The seed of the counter-based generator
+  const unsigned int _seed;
+
+  ///@{ The element of the last value and the index of the next value on it
+  const Elem * _last_elem;
+  unsigned int _elem_index;
+  ///@}
 };
 
 #endif // RANDOMIC_H
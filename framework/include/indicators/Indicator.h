@@ -56,6 +56,10 @@ public:
    * Can be overridden to do a final postprocessing of the indicator field.
    * This will allow you to sum up error from multiple places and then do something like take the
    * square root of it in this function.
+   *
+   * An Indicator that changes its value here must also leave the final value in its field
+   * variable (see MooseVariableFE::setNodalValue()): the ErrorVectors used by the Markers are
+   * filled from the field variables right after this call.
    */
   virtual void finalize(){};
 
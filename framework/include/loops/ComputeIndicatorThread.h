@@ -17,6 +17,9 @@
 // Forward declarations
 class AuxiliarySystem;
 class InternalSideIndicators;
+template <typename>
+class MooseVariableFE;
+typedef MooseVariableFE<Real> MooseVariable;
 
 class ComputeIndicatorThread : public ThreadedElementLoop<ConstElemRange>
 {
@@ -26,8 +29,13 @@ public:
    * @param sys reference to the AuxSystem we are computing on
    * @param indicator_whs Warehouse of Indicator objects.
    * @param finalize Whether or not we are just in the "finalize" stage or not.
+   * @param error_vectors ErrorVectors, by indicator field name, to fill with the finalized
+   *                      indicator values of the local elements (finalize stage only)
    */
-  ComputeIndicatorThread(FEProblemBase & fe_problem, bool finalize = false);
+  ComputeIndicatorThread(
+      FEProblemBase & fe_problem,
+      bool finalize = false,
+      const std::map<std::string, std::unique_ptr<ErrorVector>> * error_vectors = nullptr);
 
   // Splitting Constructor
   ComputeIndicatorThread(ComputeIndicatorThread & x, Threads::split split);
@@ -54,6 +62,12 @@ protected:
   const MooseObjectWarehouse<InternalSideIndicator> & _internal_side_indicators;
 
   bool _finalize;
+
+  /// ErrorVectors to fill during the finalize stage, by indicator field name
+  const std::map<std::string, std::unique_ptr<ErrorVector>> * _error_vectors;
+
+  /// The indicator fields of the current subdomain that have an ErrorVector
+  std::vector<std::pair<MooseVariable *, ErrorVector *>> _error_vector_vars;
 };
 
 #endif // COMPUTEINDICATORTHREAD_H
@@ -0,0 +1,53 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPUTEJACOBIANACTIONTHREAD_H
+#define COMPUTEJACOBIANACTIONTHREAD_H
+
+#include "ComputeFullJacobianThread.h"
+
+// libMesh forward declarations
+namespace libMesh
+{
+template <typename T>
+class NumericVector;
+}
+
+/**
+ * Computes the product of the Jacobian with a vector element by element: the element Jacobian
+ * blocks of the kernels and integrated BCs are multiplied by the local entries of the vector
+ * instead of being assembled into a matrix.
+ */
+class ComputeJacobianActionThread : public ComputeFullJacobianThread
+{
+public:
+  /**
+   * @param x The vector to multiply, ghosted like the solution
+   * @param y The vector the product is added to
+   */
+  ComputeJacobianActionThread(FEProblemBase & fe_problem,
+                              const std::set<TagID> & tags,
+                              const NumericVector<Number> & x,
+                              NumericVector<Number> & y);
+
+  // Splitting Constructor
+  ComputeJacobianActionThread(ComputeJacobianActionThread & x, Threads::split split);
+
+  virtual ~ComputeJacobianActionThread();
+
+  virtual void postElement(const Elem * /*elem*/) override;
+
+  void join(const ComputeJacobianActionThread & /*y*/) {}
+
+protected:
+  const NumericVector<Number> & _x;
+  NumericVector<Number> & _y;
+};
+
+#endif // COMPUTEJACOBIANACTIONTHREAD_H
@@ -40,6 +40,7 @@ public:
   virtual void onInterface(const Elem * elem, unsigned int side, BoundaryID bnd_id) override;
   virtual void postElement(const Elem * /*elem*/) override;
   virtual void post() override;
+  virtual bool recordElementCosts() const override { return _mesh.isRecordingElementCosts(); }
 
   void join(const ComputeJacobianThread & /*y*/);
 
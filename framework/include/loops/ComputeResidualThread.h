@@ -42,6 +42,7 @@ public:
   virtual void onInternalSide(const Elem * elem, unsigned int side) override;
   virtual void postElement(const Elem * /*elem*/) override;
   virtual void post() override;
+  virtual bool recordElementCosts() const override { return _mesh.isRecordingElementCosts(); }
 
   void join(const ComputeResidualThread & /*y*/);
 
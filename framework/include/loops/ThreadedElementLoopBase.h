@@ -15,6 +15,8 @@
 #include "MooseTypes.h"
 #include "MooseException.h"
 
+#include <chrono>
+
 /**
  * Base class for assembly-like calculations.
  */
@@ -132,6 +134,12 @@ public:
    */
   virtual bool keepGoing() { return true; }
 
+  /**
+   * Whether or not the time spent on each element should be added to the element costs recorded
+   * by the mesh, see MooseMesh::recordElementCosts()
+   */
+  virtual bool recordElementCosts() const { return false; }
+
 protected:
   MooseMesh & _mesh;
   THREAD_ID _tid;
@@ -179,6 +187,9 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
 
     _subdomain = Moose::INVALID_BLOCK_ID;
     _neighbor_subdomain = Moose::INVALID_BLOCK_ID;
+
+    const bool record_costs = recordElementCosts();
+    std::chrono::steady_clock::time_point elem_start;
     typename RangeType::const_iterator el = range.begin();
     for (el = range.begin(); el != range.end(); ++el)
     {
@@ -187,6 +198,9 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
 
       const Elem * elem = *el;
 
+      if (record_costs)
+        elem_start = std::chrono::steady_clock::now();
+
       preElement(elem);
 
       _old_subdomain = _subdomain;
@@ -229,6 +243,12 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
       } // sides
       postElement(elem);
 
+      if (record_costs)
+        _mesh.addElementCost(
+            _tid,
+            elem->id(),
+            std::chrono::duration<Real>(std::chrono::steady_clock::now() - elem_start).count());
+
     } // range
 
     post();
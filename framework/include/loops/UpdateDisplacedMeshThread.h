@@ -16,7 +16,6 @@
 
 // Forward declarations
 class DisplacedProblem;
-class UpdateDisplacedMeshThread;
 
 // libMesh forward declarations
 namespace libMesh
@@ -25,19 +24,39 @@ template <typename T>
 class NumericVector;
 }
 
-class UpdateDisplacedMeshThread : public ThreadedNodeLoop<NodeRange, NodeRange::const_iterator>
+/**
+ * Moves the nodes in a range of the displaced mesh to the reference position plus the current
+ * displacement. The displacements of the nodes in the range that are not owned by this processor
+ * are gathered when the object is constructed.
+ */
+template <typename RangeType>
+class UpdateDisplacedMeshThreadTempl
+  : public ThreadedNodeLoop<RangeType, typename RangeType::const_iterator>
 {
 public:
-  UpdateDisplacedMeshThread(FEProblemBase & fe_problem, DisplacedProblem & displaced_problem);
+  UpdateDisplacedMeshThreadTempl(FEProblemBase & fe_problem,
+                                 DisplacedProblem & displaced_problem,
+                                 const RangeType & range);
 
-  UpdateDisplacedMeshThread(UpdateDisplacedMeshThread & x, Threads::split split);
+  UpdateDisplacedMeshThreadTempl(UpdateDisplacedMeshThreadTempl & x, Threads::split split);
 
-  virtual void onNode(NodeRange::const_iterator & nd) override;
+  virtual void onNode(typename RangeType::const_iterator & nd) override;
 
-  void join(const UpdateDisplacedMeshThread & /*y*/);
+  void join(const UpdateDisplacedMeshThreadTempl & y);
+
+  /// The largest distance that a node in the range was moved
+  Real maxMotion() const { return std::sqrt(_max_motion_sq); }
 
 protected:
-  void init();
+  void init(const RangeType & range);
+
+  /**
+   * Builds the sorted list of off-processor displacement dofs needed to update the nodes in range
+   */
+  void buildSendList(const RangeType & range,
+                     const std::vector<unsigned int> & var_nums,
+                     const System & system,
+                     std::vector<dof_id_type> & send_list);
 
   DisplacedProblem & _displaced_problem;
   MooseMesh & _ref_mesh;
@@ -62,6 +81,15 @@ private:
 
   unsigned int _nonlinear_system_number;
   unsigned int _aux_system_number;
+
+  /// The square of the largest distance that a node was moved by this thread
+  Real _max_motion_sq;
 };
 
+/// Updates every node of the displaced mesh
+typedef UpdateDisplacedMeshThreadTempl<NodeRange> UpdateDisplacedMeshThread;
+
+/// Updates only the semilocal nodes of the displaced mesh
+typedef UpdateDisplacedMeshThreadTempl<SemiLocalNodeRange> UpdateSemiLocalDisplacedMeshThread;
+
 #endif /* UPDATEDISPLACEDMESHTHREAD_H */
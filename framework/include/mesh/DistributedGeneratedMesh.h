@@ -57,6 +57,12 @@ protected:
   /// _bias_x==1 implies no bias (original mesh unchanged).
   /// _bias_x > 1 implies cells are growing in the x-direction.
   Real _bias_x, _bias_y, _bias_z;
+
+  /// Whether to assign the elements to processors analytically instead of with METIS
+  const bool _block_partition;
+
+  /// Timers
+  PerfID _build_mesh_timer;
 };
 
 #endif /* DISTRIBUTEDGENERATEDMESH_H */
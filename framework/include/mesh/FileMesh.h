@@ -37,6 +37,9 @@ public:
   virtual std::string getFileName() const override { return _file_name; }
 
 protected:
+  /// Whether the given file of a pre-split mesh exists on all of the processors
+  bool splitExists(const std::string & file_name) const;
+
   /// the file_name from whence this mesh came
   std::string _file_name;
 
@@ -18,6 +18,7 @@
 #include "PerfGraphInterface.h"
 
 #include <memory> //std::unique_ptr
+#include <unordered_map>
 
 // libMesh
 #include "libmesh/bounding_box.h"
@@ -808,6 +809,54 @@ public:
   void setIsCustomPartitionerRequested(bool cpr);
   ///@}
 
+  /**
+   * Enables or disables the recording of element costs. While enabled, the residual and Jacobian
+   * loops add the time spent on each local element, which partitioners may use as element
+   * weights.
+   */
+  void recordElementCosts(bool record);
+
+  /// Whether or not element costs are being recorded
+  bool isRecordingElementCosts() const { return _record_element_costs; }
+
+  /**
+   * Adds to the recorded cost of an element; each thread writes to its own storage
+   * @param tid The thread adding the cost
+   * @param elem_id The id of the element
+   * @param cost The time (in seconds) spent on the element
+   */
+  void addElementCost(THREAD_ID tid, dof_id_type elem_id, Real cost)
+  {
+    _element_costs[tid][elem_id] += cost;
+  }
+
+  /**
+   * The cost recorded for an element since the costs were last cleared, zero if the element has
+   * not been measured
+   */
+  Real elementCost(dof_id_type elem_id) const;
+
+  /**
+   * The ratio of the largest total element cost on a processor to the average over all of the
+   * processors. This must be called on all processors.
+   */
+  Real elementCostImbalance() const;
+
+  /// Clears the recorded element costs
+  void clearElementCosts();
+
+  ///@{
+  /**
+   * Setter and getter for the element cost imbalance above which the mesh is repartitioned,
+   * zero when the mesh should not be repartitioned
+   */
+  void setElementCostImbalanceThreshold(Real threshold)
+  {
+    _element_cost_imbalance_threshold = threshold;
+  }
+  Real elementCostImbalanceThreshold() const { return _element_cost_imbalance_threshold; }
+  ///@}
+
   /// Getter to query if the mesh was detected to be regular and orthogonal
   bool isRegularOrthogonal() { return _regular_orthogonal_mesh; }
 
@@ -858,6 +907,15 @@ protected:
   std::unique_ptr<Partitioner> _custom_partitioner;
   bool _custom_partitioner_requested;
 
+  /// Whether or not the residual and Jacobian loops record the cost of each element
+  bool _record_element_costs;
+
+  /// The recorded cost of each element, for each thread
+  std::vector<std::unordered_map<dof_id_type, Real>> _element_costs;
+
+  /// The element cost imbalance above which the mesh is repartitioned
+  Real _element_cost_imbalance_threshold;
+
   /// Convenience enums
   enum
   {
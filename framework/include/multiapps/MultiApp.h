@@ -294,6 +294,12 @@ protected:
    */
   void createApp(unsigned int i, Real start_time);
 
+  /**
+   * The communicator the local app \p i is built on, by default the one shared by all of the local
+   * apps.
+   */
+  virtual MPI_Comm appComm(unsigned int /*i*/) { return _my_comm; }
+
   /**
    * Create an MPI communicator suitable for each app.
    *
@@ -14,6 +14,8 @@
 
 #include "libmesh/numeric_vector.h"
 
+#include <atomic>
+
 // Forward declarations
 class TransientMultiApp;
 class Transient;
@@ -30,6 +32,7 @@ class TransientMultiApp : public MultiApp
 {
 public:
   TransientMultiApp(const InputParameters & parameters);
+  virtual ~TransientMultiApp();
 
   virtual NumericVector<Number> & appTransferVector(unsigned int app,
                                                     std::string var_name) override;
@@ -53,6 +56,9 @@ public:
    */
   Real computeDT();
 
+protected:
+  virtual MPI_Comm appComm(unsigned int i) override;
+
 private:
   /**
    * Setup the executioner for the local app.
@@ -62,6 +68,20 @@ private:
    */
   void setupApp(unsigned int i, Real time = 0.0);
 
+  /**
+   * Solves a local app up to the target time.
+   *
+   * @param i The local app number
+   * @param dt, target_time, auto_advance See solveStep()
+   */
+  void solveApp(unsigned int i, Real dt, Real target_time, bool auto_advance);
+
+  /**
+   * Solves all of the local apps with up to _local_app_threads threads, rethrowing the exception
+   * of the lowest numbered app that failed once all of the solves are complete.
+   */
+  void solveAppsConcurrently(Real dt, Real target_time, bool auto_advance);
+
   std::vector<Transient *> _transient_executioners;
 
   bool _sub_cycling;
@@ -73,7 +93,7 @@ private:
   unsigned int _max_failures;
   bool _tolerate_failure;
 
-  unsigned int _failures;
+  std::atomic<unsigned int> _failures;
 
   bool _catch_up;
   Real _max_catch_up_steps;
@@ -86,9 +106,6 @@ private:
   /// The variables that have been transferred to.  Used when doing transfer interpolation.  This will be cleared after each solve.
   std::vector<std::string> _transferred_vars;
 
-  /// The DoFs associated with all of the currently transferred variables.
-  std::set<dof_id_type> _transferred_dofs;
-
   std::vector<std::map<std::string, unsigned int>> _output_file_numbers;
 
   bool _auto_advance;
@@ -100,6 +117,12 @@ private:
 
   /// The solution from the end of the previous solve, this is cloned from the Nonlinear solution during restore
   std::vector<std::unique_ptr<NumericVector<Real>>> _end_solutions;
+
+  /// The number of threads used to solve the local apps
+  const unsigned int _local_app_threads;
+
+  /// The communicators of the local apps when they are solved concurrently, duplicates of _my_comm
+  std::vector<MPI_Comm> _app_comms;
 };
 
 /**
@@ -17,6 +17,7 @@
 #include <deque>
 
 // Forward declarations
+class BackgroundTaskQueue;
 class Checkpoint;
 class MaterialPropertyStorage;
 
@@ -50,6 +51,8 @@ public:
    */
   Checkpoint(const InputParameters & parameters);
 
+  virtual ~Checkpoint();
+
   /**
    * Returns the base filename for the checkpoint files
    */
@@ -61,6 +64,18 @@ public:
    */
   std::string directory();
 
+  /**
+   * Blocks until the restartable data that is being written in the background has been written
+   * (see the 'asynchronous' parameter) and removes the checkpoints that are no longer needed.
+   * This must be called on all processors.
+   */
+  void waitForOutput();
+
+  /**
+   * Outputs as usual and completes the pending writes on EXEC_FINAL
+   */
+  virtual void outputStep(const ExecFlagType & type) override;
+
 protected:
   /**
    * Outputs a checkpoint file.
@@ -71,6 +86,15 @@ protected:
 private:
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Removes the oldest checkpoints until num_files complete checkpoints remain, a checkpoint is
+   * complete once its restartable data has been written on all processors
+   */
+  void removeOldCheckpointFiles();
+
+  /// Removes the restartable data files of a checkpoint
+  void removeRestartableDataFiles(const std::string & base_file_name, processor_id_type proc_id);
+
   /// Max no. of output files to store
   unsigned int _num_files;
 
@@ -98,8 +122,11 @@ private:
   /// RestrableData input/output interface
   RestartableDataIO _restartable_data_io;
 
-  /// Vector of checkpoint filename structures
+  /// Vector of checkpoint filename structures, including the incomplete checkpoints
   std::deque<CheckpointFileNames> _file_names;
+
+  /// Writes the restartable data on a background thread when 'asynchronous = true'
+  std::unique_ptr<BackgroundTaskQueue> _writer;
 };
 
 #endif // CHECKPOINT_H
@@ -15,6 +15,7 @@
 
 // Forward declarations
 class Exodus;
+class BackgroundTaskQueue;
 
 // libMesh forward declarations
 namespace libMesh
@@ -36,6 +37,11 @@ public:
    */
   Exodus(const InputParameters & parameters);
 
+  /**
+   * Class destructor, completes any output that is being written in the background
+   */
+  virtual ~Exodus();
+
   /**
    * Overload the OutputBase::output method, this is required for ExodusII
    * output due to the method utilized for outputing single/global parameters
@@ -79,6 +85,12 @@ public:
    */
   void setOutputDimension(unsigned int dim);
 
+  /**
+   * Blocks until all of the output that is being written in the background has been written
+   * to the file (see the 'asynchronous' parameter)
+   */
+  void waitForOutput();
+
 protected:
   /**
    * Outputs nodal, nonlinear variables
@@ -136,6 +148,61 @@ protected:
   bool _exodus_initialized;
 
 private:
+  /**
+   * Data for a single call to output(), gathered from all processors, that is written to the
+   * file by the background writer
+   */
+  struct OutputBuffer
+  {
+    /// The file to write
+    std::string filename;
+
+    /// True if a new timestep is started, otherwise the data is added to the last timestep
+    bool new_timestep = false;
+
+    /// The timestep (in the file) that the data is written to
+    int timestep = 0;
+
+    /// The time of the timestep
+    Real time = 0;
+
+    /// Values of the nodal variables, in the order of the nodal variables in the file
+    std::vector<std::vector<Real>> nodal_values;
+
+    /// Names of the elemental variables
+    std::vector<std::string> elemental_names;
+
+    /// Values of the elemental variables, as returned by EquationSystems::get_solution
+    std::vector<Real> elemental_values;
+
+    /// Subdomains on which each of the elemental variables is active
+    std::vector<std::set<subdomain_id_type>> elemental_subdomains;
+
+    /// Names and values of the global variables (postprocessors and scalars)
+    std::vector<std::string> global_names;
+    std::vector<Real> global_values;
+
+    /// The input file record
+    std::vector<std::string> input_record;
+  };
+
+  /**
+   * Gathers the data for the current output into a buffer and hands it to the background writer
+   * @param type The current output execution flag
+   */
+  void outputAsynchronous(const ExecFlagType & type);
+
+  /**
+   * Starts a new timestep in the buffer of the current asynchronous output
+   */
+  void bufferTimestep();
+
+  /**
+   * Writes a buffer gathered by outputAsynchronous() to the file, this is executed on the
+   * background writer and only on processor 0
+   */
+  void writeBuffer(const OutputBuffer & buffer);
+
   /**
    * A helper function for 'initializing' the ExodusII output file, see the comments for the
    * _initialized
@@ -167,6 +234,16 @@ private:
 
   /// Flag to output discontinuous format in Exodus
   bool _discontinuous;
+
+  /// Flag for writing the data to the file on a background thread
+  const bool _asynchronous;
+
+  /// The buffer being filled by the current asynchronous output, nullptr otherwise
+  std::unique_ptr<OutputBuffer> _buffer;
+
+  /// Executes writeBuffer() in the background; while output is pending it is the only user of
+  /// _exodus_io_ptr (destroyed before _exodus_io_ptr, completing the pending output)
+  std::unique_ptr<BackgroundTaskQueue> _writer;
 };
 
 #endif /* EXODUS_H */
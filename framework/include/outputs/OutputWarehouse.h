@@ -13,6 +13,9 @@
 // MOOSE includes
 #include "Output.h"
 
+// C++ includes
+#include <mutex>
+
 // Forward declarations
 class FEProblemBase;
 class InputParameters;
@@ -171,6 +174,12 @@ public:
    */
   void mooseConsole();
 
+  /**
+   * The mutex held while the output objects of any application in this process write, so that
+   * the output of applications solved concurrently (see TransientMultiApp) is not interleaved
+   */
+  static std::recursive_mutex & outputMutex();
+
   /**
    * The buffered messages stream for Console objects
    * @return Reference to the stream storing cached messages from calls to _console
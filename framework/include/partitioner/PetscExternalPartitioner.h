@@ -30,6 +30,10 @@ public:
 
   virtual std::unique_ptr<Partitioner> clone() const override;
 
+  /**
+   * The weight of an element: one, or its measured cost relative to the average cost when
+   * 'element_weight = measured'
+   */
   virtual dof_id_type computeElementWeight(Elem & elm);
 
   virtual dof_id_type computeSideWeight(Elem & elem, unsigned int side);
@@ -37,10 +41,24 @@ public:
 protected:
   virtual void _do_partition(MeshBase & mesh, const unsigned int n) override;
 
+  /**
+   * Computes the average of the measured costs of the elements being partitioned
+   */
+  void computeAverageCost(MeshBase & mesh);
+
 private:
   std::string _part_package;
   bool _apply_element_weight;
   bool _apply_side_weight;
+
+  /// Whether or not the element weights are the measured element costs
+  const bool _measured_element_weight;
+
+  /// The mesh that records the element costs
+  MooseMesh * _mesh;
+
+  /// The average measured cost of the elements being partitioned, zero if none were measured
+  Real _average_cost;
 };
 
 #endif /* PETSCEXTERNALPARTITIONER_H */
@@ -0,0 +1,36 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef NUMLAGGEDJACOBIANS_H
+#define NUMLAGGEDJACOBIANS_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class NumLaggedJacobians;
+
+template <>
+InputParameters validParams<NumLaggedJacobians>();
+
+/**
+ * Returns the number of Jacobian evaluations in the just-completed solve that reused a
+ * previously assembled Jacobian, see the Executioner parameter max_jacobian_lag.
+ */
+class NumLaggedJacobians : public GeneralPostprocessor
+{
+public:
+  NumLaggedJacobians(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() override;
+};
+
+#endif // NUMLAGGEDJACOBIANS_H
@@ -73,6 +73,12 @@ public:
   virtual void setup();
 
 protected:
+  /**
+   * Fills the maps between the local dofs of each variable in the nonlinear system and the dofs
+   * of its preconditioning system, which apply() uses to copy the vectors between the systems.
+   */
+  void buildDofMaps();
+
   /// The nonlinear system this PBP is associated with (convenience reference)
   NonlinearSystemBase & _nl;
   /// List of linear system that build up the preconditioner
@@ -95,6 +101,13 @@ protected:
    */
   std::vector<std::vector<SparseMatrix<Number> *>> _off_diag_mats;
 
+  /// The local dofs of each variable in the nonlinear system
+  std::vector<std::vector<numeric_index_type>> _nl_dofs;
+  /// The dofs of each preconditioning system, in the same order as _nl_dofs
+  std::vector<std::vector<numeric_index_type>> _system_dofs;
+  /// Buffer for the values copied between the nonlinear system and the preconditioning systems
+  std::vector<Number> _copy_values;
+
   /// Timers
   PerfID _init_timer;
   PerfID _apply_timer;
@@ -274,6 +274,13 @@ public:
   void undisplaceMesh();
 
 protected:
+  /**
+   * Moves the nodes of the displaced mesh by the current displacements and then updates the
+   * geometric searches and the Dirac kernel point locator, unless the nodes have moved less than
+   * the search update tolerance since those were last updated.
+   */
+  void displaceNodes();
+
   FEProblemBase & _mproblem;
   MooseMesh & _mesh;
   EquationSystems _eq;
@@ -291,14 +298,25 @@ protected:
 
   GeometricSearchData _geometric_search_data;
 
+  /// Whether to displace only the semilocal nodes of a distributed mesh
+  const bool _semilocal_update;
+
+  /// Distance the nodes may move before the geometric searches are updated
+  const Real _search_update_tolerance;
+
+  /// Upper bound on the distance that a node has moved since the searches were last updated
+  Real _motion_since_search_update;
+
   /// Timers
   PerfID _eq_init_timer;
   PerfID _update_mesh_timer;
   PerfID _sync_solutions_timer;
   PerfID _update_geometric_search_timer;
+  PerfID _update_searches_timer;
 
 private:
-  friend class UpdateDisplacedMeshThread;
+  template <typename>
+  friend class UpdateDisplacedMeshThreadTempl;
   friend class Restartable;
 };
 
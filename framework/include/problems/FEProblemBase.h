@@ -74,6 +74,7 @@ class Sampler;
 class KernelBase;
 class IntegratedBCBase;
 class LineSearch;
+class JacobianLaggingPolicy;
 
 // libMesh forward declarations
 namespace libMesh
@@ -819,12 +820,14 @@ public:
    * history of the values
    * @param is_broadcast True if the vector will already be replicated by the VPP.  This prevents
    * unnecessary broadcasting by MOOSE.
+   * @param is_distributed True if each processor holds a different part of the vector
    * @return The reference to the vector declared
    */
   VectorPostprocessorValue & declareVectorPostprocessorVector(const VectorPostprocessorName & name,
                                                               const std::string & vector_name,
                                                               bool contains_complete_history,
-                                                              bool is_broadcast);
+                                                              bool is_broadcast,
+                                                              bool is_distributed = false);
 
   /**
    * Whether or not the specified VectorPostprocessor has declared any vectors
@@ -1037,6 +1040,18 @@ public:
    */
   virtual void computeJacobianTags(const std::set<TagID> & tags);
 
+  /**
+   * Computes the product of the Jacobian, evaluated at soln, with x without assembling the
+   * Jacobian. The user objects and auxiliary variables are not recomputed: they are those of the
+   * last residual or Jacobian evaluation, which must have been at soln.
+   * @param soln The solution the Jacobian is evaluated at
+   * @param x The vector to multiply, ghosted like the solution
+   * @param y The product
+   */
+  virtual void computeJacobianAction(const NumericVector<Number> & soln,
+                                     const NumericVector<Number> & x,
+                                     NumericVector<Number> & y);
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller
    * preconditioning matrices.
@@ -1233,6 +1248,14 @@ public:
   bool hasInitialAdaptivity() const { return false; }
 #endif // LIBMESH_ENABLE_AMR
 
+  /**
+   * Repartitions the mesh when the measured element costs (see
+   * MooseMesh::recordElementCosts()) are imbalanced by more than the threshold set on the mesh,
+   * then clears the costs
+   * @returns Whether or not the mesh was repartitioned
+   */
+  virtual bool rebalanceMesh();
+
   /// Create XFEM controller object
   void initXFEM(std::shared_ptr<XFEMInterface> xfem);
 
@@ -1272,6 +1295,19 @@ public:
    */
   void setConstJacobian(bool state) { _const_jacobian = state; }
 
+  /**
+   * Enables reusing the assembled Jacobian, and the preconditioner built from it, for several
+   * evaluations (see JacobianLaggingPolicy)
+   * @param max_lag The maximum number of evaluations that use the same Jacobian, 1 disables lagging
+   * @param convergence_rate The residual reduction factor per nonlinear iteration above which the
+   *                         Jacobian is reassembled
+   * @param dt_change The relative time step size change above which the Jacobian is reassembled
+   */
+  void setJacobianLagging(unsigned int max_lag, Real convergence_rate, Real dt_change);
+
+  /// The Jacobian lagging policy, nullptr if the Jacobian is assembled for every evaluation
+  const JacobianLaggingPolicy * getJacobianLaggingPolicy() const { return _jacobian_lagging.get(); }
+
   /**
    * Set flag to indicate whether kernel coverage checks should be performed. This check makes
    * sure that at least one kernel is active on all subdomains in the domain (default: true).
@@ -1638,12 +1674,18 @@ protected:
 #ifdef LIBMESH_ENABLE_AMR
   Adaptivity _adaptivity;
   unsigned int _cycles_completed;
+
+  /// Whether the ErrorVectors were filled by computeIndicators() and are ready for the Markers
+  bool _error_vectors_updated;
 #endif
 
   /// Pointer to XFEM controller
   std::shared_ptr<XFEMInterface> _xfem;
 
   // Displaced mesh /////
+  /// The element cost imbalance that caused the last repartitioning, zero once it has been reported
+  Real _repartitioned_imbalance;
+
   MooseMesh * _displaced_mesh;
   std::shared_ptr<DisplacedProblem> _displaced_problem;
   GeometricSearchData _geometric_search_data;
@@ -1672,6 +1714,12 @@ protected:
   /// Indicates if the Jacobian was computed
   bool _has_jacobian;
 
+  /// Decides when the Jacobian may be reused, nullptr when it is assembled for every evaluation
+  std::unique_ptr<JacobianLaggingPolicy> _jacobian_lagging;
+
+  /// Whether the current system Jacobian evaluation reuses the previously assembled Jacobian
+  bool _lag_jacobian;
+
   /// Indicates that we need to compute variable values for previous Newton iteration
   bool _needs_old_newton_iter;
 
@@ -1764,6 +1812,8 @@ private:
   PerfID _compute_transient_implicit_residual_timer;
   PerfID _compute_residual_tags_timer;
   PerfID _compute_jacobian_internal_timer;
+  PerfID _lag_jacobian_timer;
+  PerfID _compute_jacobian_action_timer;
   PerfID _compute_jacobian_tags_timer;
   PerfID _compute_jacobian_blocks_timer;
   PerfID _compute_bounds_timer;
@@ -1775,6 +1825,9 @@ private:
   PerfID _update_mesh_xfem_timer;
   PerfID _mesh_changed_timer;
   PerfID _mesh_changed_helper_timer;
+  PerfID _rebalance_mesh_timer;
+  PerfID _prolong_stateful_props_timer;
+  PerfID _restrict_stateful_props_timer;
   PerfID _check_problem_integrity_timer;
   PerfID _serialize_solution_timer;
   PerfID _check_nonlinear_convergence_timer;
@@ -42,6 +42,33 @@ public:
                             const RestartableDatas & restartable_datas,
                             std::set<std::string> & _recoverable_data);
 
+  /**
+   * Serializes the restartable data of each thread into memory, the result is written to the
+   * files by writeRestartableData(base_file_name, data)
+   */
+  std::vector<std::string> serializeRestartableData(const RestartableDatas & restartable_datas);
+
+  /**
+   * Write out restartable data that was serialized by serializeRestartableData(). Each file is
+   * written with a temporary name and renamed when it is complete, so a partially written file is
+   * never read. This does not use the FEProblemBase, it may be called from a background thread,
+   * and failures are reported by throwing std::runtime_error rather than with mooseError.
+   * @param base_file_name The base name of the files
+   * @param proc_id The id of this processor
+   * @param data The serialized data of each thread
+   */
+  static void writeRestartableData(const std::string & base_file_name,
+                                   processor_id_type proc_id,
+                                   const std::vector<std::string> & data);
+
+  /**
+   * The name of the file that holds the restartable data of a thread
+   */
+  static std::string restartableDataFileName(const std::string & base_file_name,
+                                             processor_id_type proc_id,
+                                             THREAD_ID tid,
+                                             unsigned int n_threads);
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of
    * processors and threads.
@@ -166,6 +166,17 @@ protected:
   void computeNodalVars(ExecFlagType type);
   void computeElementalVars(ExecFlagType type);
 
+  /**
+   * Called before a sweep that executes the given AuxKernels: closes and localizes the solution if
+   * they read a variable, directly or through a material, that an earlier sweep wrote. Sweeps that
+   * are independent of each other therefore share a single update.
+   */
+  template <typename T>
+  void prepareSweep(const std::map<T, std::vector<std::shared_ptr<AuxKernel>>> & objects);
+
+  /// Closes and localizes the solution if values have been inserted since the last update
+  void updateSolution();
+
   FEProblemBase & _fe_problem;
 
   TransientExplicitSystem & _sys;
@@ -197,6 +208,9 @@ protected:
   // Storage for AuxKernel objects
   ExecuteMooseObjectWarehouse<AuxKernel> _elemental_aux_storage;
 
+  /// Variables whose values have been inserted into the solution since it was last updated
+  std::set<const MooseVariableFEBase *> _modified_vars;
+
   /// Timers
   PerfID _compute_scalar_vars_timer;
   PerfID _compute_nodal_vars_timer;
@@ -34,6 +34,8 @@ public:
    */
   virtual void stopSolve() override;
 
+  virtual void setReusePreconditioner(bool reuse) override;
+
   /**
    * Returns the current nonlinear iteration number.  In libmesh, this is
    * updated during the nonlinear solve, so it should be up-to-date.
@@ -70,11 +72,37 @@ public:
 
   virtual TransientNonlinearImplicitSystem & sys() { return _transient_sys; }
 
+  /**
+   * Saves the state that the element Jacobian action is evaluated at, and assembles the
+   * preconditioning matrix at that state when one is given. Called by the solver at each
+   * nonlinear iteration when jacobian_action = element.
+   * @param state The solution the Jacobian is evaluated at
+   * @param preconditioner The preconditioning matrix to assemble, nullptr for JFNK
+   */
+  void setupJacobianAction(const NumericVector<Number> & state,
+                           SparseMatrix<Number> * preconditioner);
+
+  /**
+   * Computes the product of the Jacobian, at the state saved by setupJacobianAction(), with x
+   */
+  void jacobianAction(const NumericVector<Number> & x, NumericVector<Number> & y);
+
 protected:
   TransientNonlinearImplicitSystem & _transient_sys;
   ComputeResidualFunctor _nl_residual_functor;
   ComputeFDResidualFunctor _fd_residual_functor;
 
+  /// The state the element Jacobian action is evaluated at, ghosted like the solution
+  std::unique_ptr<NumericVector<Number>> _jacobian_action_state;
+
+  /// Ghosted copy of the vector the element Jacobian action is applied to
+  std::unique_ptr<NumericVector<Number>> _jacobian_action_x;
+
+#ifdef LIBMESH_HAVE_PETSC
+  /// Shell matrix that applies the element Jacobian action, used as the solver's operator
+  Mat _jacobian_action_mat;
+#endif
+
 private:
   /**
    * Form preconditioning matrix via a standard finite difference method
@@ -95,6 +123,14 @@ private:
    */
   void setupColoringFiniteDifferencedPreconditioner();
 
+  /**
+   * Replaces the finite differenced operator of JFNK and PJFNK by a shell matrix that multiplies
+   * the element Jacobians by the Krylov vectors, see jacobian_action = element. The Jacobian is
+   * never assembled for the operator, so its memory scales with the number of elements rather
+   * than the number of nonzeros and no residual is evaluated by the Krylov iterations.
+   */
+  void setupElementJacobianAction();
+
   bool _use_coloring_finite_difference;
 };
 
@@ -79,6 +79,12 @@ public:
    */
   virtual void stopSolve() = 0;
 
+  /**
+   * Whether the solver should keep the current preconditioner at the next Jacobian evaluation
+   * instead of rebuilding it from the Jacobian, which is used when the Jacobian is lagged
+   */
+  virtual void setReusePreconditioner(bool /*reuse*/) {}
+
   virtual NonlinearSolver<Number> * nonlinearSolver() = 0;
 
   virtual unsigned int getCurrentNonlinearIterationNumber() = 0;
@@ -294,6 +300,21 @@ public:
    */
   void computeJacobian(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Computes the product of the system Jacobian with a vector without assembling the Jacobian:
+   * the element Jacobians of the kernels and integrated BCs, and the rows of the nodal BCs, are
+   * multiplied by the vector directly. The Jacobian is evaluated at the current solution.
+   * @param x The vector to multiply, ghosted like the solution
+   * @param y The product
+   */
+  void computeJacobianAction(const NumericVector<Number> & x, NumericVector<Number> & y);
+
+  /**
+   * Errors if the system contains objects whose Jacobian contributions are not included in
+   * computeJacobianAction()
+   */
+  void checkJacobianActionSupport();
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller
    * preconditioning matrices.
@@ -618,6 +639,12 @@ protected:
    */
   void computeJacobianInternal(const std::set<TagID> & tags);
 
+  /**
+   * Computes the Jacobians of the nodal BCs that have at least one of the given tags and caches
+   * them on the assembly of thread 0
+   */
+  void cacheNodalBCJacobians(const std::set<TagID> & tags);
+
   void computeDiracContributions(bool is_jacobian);
 
   void computeScalarKernelsJacobians();
@@ -800,6 +827,7 @@ protected:
   PerfID _nodal_bcs_timer;
   PerfID _compute_jacobian_tags_timer;
   PerfID _compute_jacobian_blocks_timer;
+  PerfID _compute_jacobian_action_timer;
   PerfID _compute_dampers_timer;
   PerfID _compute_dirac_timer;
 };
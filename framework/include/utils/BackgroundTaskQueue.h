@@ -0,0 +1,95 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef BACKGROUNDTASKQUEUE_H
+#define BACKGROUNDTASKQUEUE_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * Executes tasks, in the order that they are added, on a single worker thread.
+ *
+ * This is intended for writing files without blocking the simulation: the caller copies the
+ * data to be written into the task and continues. The number of pending (queued or running)
+ * tasks is limited, add() blocks while the limit is reached, which bounds the memory held by
+ * the copied data.
+ *
+ * The first exception thrown by a task is stored and rethrown on the calling thread by the next
+ * call to add() or wait(). Tasks must not perform parallel communication.
+ */
+class BackgroundTaskQueue
+{
+public:
+  /**
+   * @param max_pending The maximum number of queued or running tasks
+   */
+  BackgroundTaskQueue(unsigned int max_pending);
+
+  /**
+   * Completes the pending tasks and stops the worker thread
+   */
+  ~BackgroundTaskQueue();
+
+  /**
+   * Adds a task to the queue, blocks while the maximum number of tasks are pending
+   * @param task The function to execute on the worker thread
+   */
+  void add(std::function<void()> task);
+
+  /**
+   * Blocks until all of the tasks that have been added have completed
+   */
+  void wait();
+
+  /**
+   * The number of queued or running tasks
+   */
+  std::size_t pending() const;
+
+protected:
+  /// The loop executed by the worker thread
+  void run();
+
+  /// Rethrows, and clears, an exception thrown by a task; must be called with _mutex locked
+  void rethrow();
+
+  /// The maximum number of queued or running tasks
+  const unsigned int _max_pending;
+
+  /// Tasks waiting to be executed
+  std::deque<std::function<void()>> _tasks;
+
+  /// Number of queued or running tasks
+  std::size_t _pending;
+
+  /// Set when the worker thread should exit once the queue is empty
+  bool _stop;
+
+  /// The first exception thrown by a task that has not yet been rethrown
+  std::exception_ptr _exception;
+
+  /// Protects all of the above
+  mutable std::mutex _mutex;
+
+  /// Signalled when a task is added or the worker should stop
+  std::condition_variable _task_added;
+
+  /// Signalled when a task completes
+  std::condition_variable _task_done;
+
+  /// The worker thread
+  std::thread _thread;
+};
+
+#endif // BACKGROUNDTASKQUEUE_H
@@ -0,0 +1,94 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COUNTERRANDOM_H
+#define COUNTERRANDOM_H
+
+#include <array>
+#include <cstdint>
+
+/**
+ * A stateless, counter-based random number generator built on the Philox-4x32-10 block function
+ * (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11).
+ *
+ * Unlike MooseRandom, no generator state is stored: each number is computed directly from a
+ * seed, a stream (e.g. the time step), the id of an entity (element, node, ...) and the index of
+ * the number drawn for that entity. The numbers therefore do not depend on the order in which the
+ * entities are visited, on the partitioning of the mesh or on the number of threads.
+ */
+class CounterRandom
+{
+public:
+  /**
+   * The Philox-4x32-10 block function, which maps a counter and a key to four random words
+   * @param counter The counter
+   * @param key The key
+   * @return Four random 32-bit numbers
+   */
+  static inline std::array<uint32_t, 4> philox(std::array<uint32_t, 4> counter,
+                                               std::array<uint32_t, 2> key)
+  {
+    for (unsigned int round = 0; round < 10; ++round)
+    {
+      if (round > 0)
+      {
+        key[0] += 0x9E3779B9;
+        key[1] += 0xBB67AE85;
+      }
+
+      const uint64_t product0 = static_cast<uint64_t>(0xD2511F53) * counter[0];
+      const uint64_t product1 = static_cast<uint64_t>(0xCD9E8D57) * counter[2];
+
+      counter = {{static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                  static_cast<uint32_t>(product1),
+                  static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                  static_cast<uint32_t>(product0)}};
+    }
+
+    return counter;
+  }
+
+  /**
+   * This method returns a random number (long format)
+   * @param seed    the seed number
+   * @param stream  the stream, which selects an independent sequence for the same seed
+   * @param id      the id of the entity
+   * @param index   the index of the number in the sequence of the entity
+   * @return        a random number in the range [0,max(uint32_t)]
+   */
+  static inline uint32_t randl(uint32_t seed, uint32_t stream, uint64_t id, uint32_t index)
+  {
+    return block(seed, stream, id, index)[0];
+  }
+
+  /**
+   * This method returns a random number (double format)
+   * @param seed    the seed number
+   * @param stream  the stream, which selects an independent sequence for the same seed
+   * @param id      the id of the entity
+   * @param index   the index of the number in the sequence of the entity
+   * @return        a random number in the range [0,1) with 53-bit precision
+   */
+  static inline double rand(uint32_t seed, uint32_t stream, uint64_t id, uint32_t index)
+  {
+    const auto words = block(seed, stream, id, index);
+    const uint64_t bits = (static_cast<uint64_t>(words[0]) << 21) ^ (words[1] >> 11);
+    return bits * (1.0 / 9007199254740992.0); // 2^-53
+  }
+
+private:
+  static inline std::array<uint32_t, 4>
+  block(uint32_t seed, uint32_t stream, uint64_t id, uint32_t index)
+  {
+    return philox({{index, 0, static_cast<uint32_t>(id), static_cast<uint32_t>(id >> 32)}},
+                  {{seed, stream}});
+  }
+};
+
+#endif // COUNTERRANDOM_H
@@ -15,10 +15,13 @@
 using namespace libMesh;
 
 // C++ includes
+#include <cstdint>
 #include <iosfwd>
 #include <string>
 #include <vector>
 
+class SharedDataStore;
+
 /**
  * Container for holding a function defined on a grid of arbitrary dimension.
  *
@@ -30,6 +33,12 @@ using namespace libMesh;
  * direction that each grid axis corresponds to.  For instance, the
  * first grid axis might correspond to the MOOSE "y" direction, the
  * second grid axis might correspond to the MOOSE "t" direction, etc.
+ *
+ * The file is either the text format described in GriddedData.C or the binary format written by
+ * writeBinary(). A binary file is memory mapped read-only rather than read, so loading it is
+ * fast and the function values are shared by every process and thread on a node that uses the
+ * same file. A text file can be parsed once per node instead, with its binary image held in a
+ * SharedDataStore.
  */
 class GriddedData
 {
@@ -39,7 +48,16 @@ public:
    */
   GriddedData(std::string file_name);
 
-  virtual ~GriddedData() = default;
+  /**
+   * Construct with a file name, parsing a text file on one process per node only and sharing the
+   * result through the store. This must be called on all processes.
+   */
+  GriddedData(std::string file_name, SharedDataStore & store);
+
+  virtual ~GriddedData();
+
+  GriddedData(const GriddedData &) = delete;
+  GriddedData & operator=(const GriddedData &) = delete;
 
   /**
    * Returns the dimensionality of the grid.
@@ -77,6 +95,25 @@ public:
    */
   Real evaluateFcn(const std::vector<unsigned int> & ijk);
 
+  /**
+   * Writes the grid and the function values in the binary format, which can be read much faster
+   * than the text format. The file is written in the native byte order:
+   *   8 characters: MOOSEGRD
+   *   uint32: the version of the format, binary_version
+   *   uint32: 0x01020304, which detects files written with a different byte order
+   *   uint64: the dimension of the grid, dim
+   *   dim pairs of int64 (the axis, 0-3 for X, Y, Z and T) and uint64 (the number of grid points)
+   *   doubles: the grid along each axis, in order
+   *   doubles: the function values, ordered as in the text format
+   */
+  void writeBinary(const std::string & file_name) const;
+
+  /// Whether or not the data was memory mapped from a binary file
+  bool isMapped() const { return _mapped != nullptr; }
+
+  /// The version of the binary format written by writeBinary()
+  static const uint32_t binary_version = 1;
+
 private:
   unsigned int _dim;
   std::vector<int> _axes;
@@ -84,11 +121,32 @@ private:
   std::vector<Real> _fcn;
   std::vector<unsigned int> _step;
 
+  ///@{ The function values, which are either _fcn or in the memory-mapped file
+  const Real * _fcn_data;
+  std::size_t _fcn_size;
+  ///@}
+
+  ///@{ The memory-mapped binary file
+  void * _mapped;
+  std::size_t _mapped_size;
+  ///@}
+
+  /// Maps a binary file, returns false if the file is not in the binary format
+  bool mapBinary(const std::string & file_name);
+
+  /// Reads the binary format from memory, the function values are used in place
+  void readBinary(const char * data, std::size_t size, const std::string & file_name);
+
+  /// Writes the binary format to a stream
+  void writeBinary(std::ostream & stream) const;
+
+  /// Computes _step and checks the number of function values
+  void setup();
+
   void parse(unsigned int & dim,
              std::vector<int> & axes,
              std::vector<std::vector<Real>> & grid,
              std::vector<Real> & f,
-             std::vector<unsigned int> & step,
              std::string file_name);
   bool getSignificantLine(std::ifstream & file_stream, std::string & line);
   void splitToRealVec(const std::string & input_string, std::vector<Real> & output_vec);
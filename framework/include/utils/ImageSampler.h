@@ -16,6 +16,9 @@
 
 #include "libmesh/bounding_box.h"
 
+// C++ includes
+#include <array>
+
 // VTK includes
 #ifdef LIBMESH_HAVE_VTK
 
@@ -68,6 +71,13 @@ public:
    */
   virtual Real sample(const Point & p);
 
+  /**
+   * Return the pixel values for a number of points, sampled in parallel over the threads
+   * @param points The points at which to extract pixel data
+   * @param values The pixel values at the points
+   */
+  void samplePoints(const std::vector<Point> & points, std::vector<Real> & values) const;
+
   /**
    * Perform initialization of image data
    */
@@ -99,6 +109,11 @@ protected:
   void vtkFlip();
 
 private:
+  /**
+   * Return the value of the pixel containing the given point, the point must be in the image
+   */
+  Real pixelValue(const Point & p) const;
+
 #ifdef LIBMESH_HAVE_VTK
 
   /// List of file names to extract data
@@ -147,6 +162,15 @@ private:
   /// Physical pixel size
   std::vector<double> _voxel;
 
+  /// The pixel values after filtering, ordered by x, then y and then z pixel index
+  std::vector<Real> _pixels;
+
+  /// The offsets between consecutive pixels in _pixels along each axis, zero for flat axes
+  std::array<std::size_t, LIBMESH_DIM> _stride;
+
+  /// The pixel size along each axis, one for flat axes to avoid dividing by zero
+  std::array<Real, LIBMESH_DIM> _divisor;
+
 /// Component to extract
 #ifdef LIBMESH_HAVE_VTK
   unsigned int _component;
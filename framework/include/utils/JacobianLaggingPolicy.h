@@ -0,0 +1,80 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef JACOBIANLAGGINGPOLICY_H
+#define JACOBIANLAGGINGPOLICY_H
+
+#include "MooseTypes.h"
+
+/**
+ * Decides when the assembled Jacobian, and with it the preconditioner built from it, may be reused
+ * instead of being reassembled.
+ *
+ * A Jacobian is used for at most max_lag evaluations, across Newton iterations and time steps. It
+ * is reassembled early when the nonlinear residual is reduced by less than the convergence rate
+ * between iterations, when the time step size changes by more than the relative dt change, or
+ * after refresh() is called, e.g. because the mesh changed or a solve failed.
+ */
+class JacobianLaggingPolicy
+{
+public:
+  /**
+   * @param max_lag The maximum number of Jacobian evaluations that use the same assembled Jacobian
+   * @param convergence_rate The residual reduction factor per nonlinear iteration above which the
+   *                         Jacobian is refreshed
+   * @param dt_change The relative change of the time step size above which the Jacobian is
+   *                  refreshed
+   */
+  JacobianLaggingPolicy(unsigned int max_lag, Real convergence_rate, Real dt_change);
+
+  /**
+   * Called for each Jacobian evaluation, returns true if the Jacobian must be assembled and false
+   * if the previously assembled Jacobian may be reused.
+   * @param dt The current time step size
+   */
+  bool needsJacobian(Real dt);
+
+  /**
+   * Called with the residual norm of each nonlinear iteration
+   * @param it The nonlinear iteration, 0 for the initial residual of a solve
+   * @param fnorm The residual norm
+   */
+  void residualNorm(unsigned int it, Real fnorm);
+
+  /// Forces the Jacobian to be assembled at the next evaluation
+  void refresh() { _refresh = true; }
+
+  /// The number of Jacobian evaluations that were assembled during the current solve
+  unsigned int numAssembled() const { return _num_assembled; }
+
+  /// The number of Jacobian evaluations that reused a previous Jacobian during the current solve
+  unsigned int numLagged() const { return _num_lagged; }
+
+protected:
+  const unsigned int _max_lag;
+  const Real _convergence_rate;
+  const Real _dt_change;
+
+  /// Whether the next evaluation must assemble the Jacobian
+  bool _refresh;
+
+  /// The number of times the current Jacobian has been reused
+  unsigned int _reuses;
+
+  /// The time step size when the current Jacobian was assembled
+  Real _dt;
+
+  /// The residual norm of the previous nonlinear iteration
+  Real _previous_fnorm;
+
+  unsigned int _num_assembled;
+  unsigned int _num_lagged;
+};
+
+#endif // JACOBIANLAGGINGPOLICY_H
@@ -10,13 +10,25 @@
 #ifndef ARRAY_H
 #define ARRAY_H
 
+#include <cstdlib>
+#include <new>
 #include <vector>
 #include "MooseError.h"
 
+/**
+ * A fixed-capacity array of quadrature point data that is resized in place.
+ *
+ * The storage is aligned to MooseArray<T>::alignment bytes (a cache line) so that loops over the
+ * entries can use aligned vector instructions, and it is only reallocated when it grows, so
+ * changing to an element type with fewer quadrature points never frees memory.
+ */
 template <typename T>
 class MooseArray
 {
 public:
+  /// The alignment of the storage in bytes
+  static const std::size_t alignment = 64;
+
   /**
    * Default constructor.  Doesn't initialize anything.
    */
@@ -52,7 +64,7 @@ public:
   {
     if (_data != NULL)
     {
-      delete[] _data;
+      deallocate(_data, _allocated_size);
       _data = NULL;
       _allocated_size = _size = 0;
     }
@@ -169,7 +181,24 @@ public:
    */
   std::vector<T> stdVector();
 
+  /**
+   * The pointer to the first element, aligned to the alignment unless the array is a shallow copy
+   * of a std::vector
+   */
+  T * data() { return _data; }
+  const T * data() const { return _data; }
+
 private:
+  /**
+   * Allocates aligned storage for size default-initialized elements
+   */
+  static T * allocate(const unsigned int size);
+
+  /**
+   * Destroys the elements and frees storage obtained from allocate()
+   */
+  static void deallocate(T * data, const unsigned int size);
+
   /// Actual data pointer.
   T * _data;
 
@@ -180,6 +209,45 @@ private:
   unsigned int _allocated_size;
 };
 
+template <typename T>
+const std::size_t MooseArray<T>::alignment;
+
+template <typename T>
+inline T *
+MooseArray<T>::allocate(const unsigned int size)
+{
+  static_assert(alignof(T) <= alignment, "MooseArray cannot store over-aligned types");
+
+  void * storage = NULL;
+  if (posix_memalign(&storage, alignment, size * sizeof(T)) != 0)
+    throw std::bad_alloc();
+
+  // Default-initialize like new T[size]
+  T * data = static_cast<T *>(storage);
+  unsigned int i = 0;
+  try
+  {
+    for (; i < size; i++)
+      new (data + i) T;
+  }
+  catch (...)
+  {
+    deallocate(data, i);
+    throw;
+  }
+
+  return data;
+}
+
+template <typename T>
+inline void
+MooseArray<T>::deallocate(T * data, const unsigned int size)
+{
+  for (unsigned int i = 0; i < size; i++)
+    data[i].~T();
+  free(data);
+}
+
 template <typename T>
 inline void
 MooseArray<T>::setAllValues(const T & value)
@@ -203,11 +271,10 @@ MooseArray<T>::resize(const unsigned int size)
     _size = size;
   else
   {
-    T * new_pointer = new T[size];
-    mooseAssert(new_pointer, "Failed to allocate MooseArray memory!");
+    T * new_pointer = allocate(size);
 
     if (_data != NULL)
-      delete[] _data;
+      deallocate(_data, _allocated_size);
     _data = new_pointer;
     _allocated_size = size;
     _size = size;
@@ -220,14 +287,13 @@ MooseArray<T>::resize(const unsigned int size, const T & default_value)
 {
   if (size > _allocated_size)
   {
-    T * new_pointer = new T[size];
-    mooseAssert(new_pointer, "Failed to allocate MooseArray memory!");
+    T * new_pointer = allocate(size);
 
     if (_data != NULL)
     {
       for (unsigned int i = 0; i < _size; i++)
         new_pointer[i] = _data[i];
-      delete[] _data;
+      deallocate(_data, _allocated_size);
     }
 
     _data = new_pointer;
@@ -14,6 +14,7 @@
 #include "MooseError.h"
 #include "DataIO.h"
 
+#include <atomic>
 #include <unordered_map>
 
 // External library includes
@@ -41,13 +42,21 @@ public:
    * The method seeds the random number generator
    * @param seed  the seed number
    */
-  static inline void seed(unsigned int seed) { mt_seed32new(seed); }
+  static inline void seed(unsigned int seed)
+  {
+    checkGlobalAllowed();
+    mt_seed32new(seed);
+  }
 
   /**
    * This method returns the next random number (double format) from the generator
    * @return      the next random number in the range [0,1) with 64-bit precision
    */
-  static inline double rand() { return mt_ldrand(); }
+  static inline double rand()
+  {
+    checkGlobalAllowed();
+    return mt_ldrand();
+  }
 
   /**
    * This method returns the next random number (double format) from the generator,
@@ -57,7 +66,11 @@ public:
    * @return      the next random number following a normal distribution of width sigma around mean
    * with 64-bit precision
    */
-  static inline double randNormal(double mean, double sigma) { return rd_normal(mean, sigma); }
+  static inline double randNormal(double mean, double sigma)
+  {
+    checkGlobalAllowed();
+    return rd_normal(mean, sigma);
+  }
 
   /**
    * Return next random number drawn from a standard distribution.
@@ -68,7 +81,18 @@ public:
    * This method returns the next random number (long format) from the generator
    * @return      the next random number in the range [0,max(uinit32_t)) with 32-bit number
    */
-  static inline uint32_t randl() { return mt_lrand(); }
+  static inline uint32_t randl()
+  {
+    checkGlobalAllowed();
+    return mt_lrand();
+  }
+
+  /**
+   * Sets whether the generator used by the static functions above may be used. That generator is
+   * shared by every application in the process, so it is disabled while sub-apps are solved
+   * concurrently (see TransientMultiApp's local_app_threads).
+   */
+  static void allowGlobal(bool allow) { globalAllowed() = allow; }
 
   /**
    * The method seeds one of the independent random number generators
@@ -152,6 +176,21 @@ public:
   inline unsigned int size() { return _states.size(); }
 
 private:
+  /// Whether the generator used by the static functions may be used
+  static std::atomic<bool> & globalAllowed()
+  {
+    static std::atomic<bool> allowed(true);
+    return allowed;
+  }
+
+  static void checkGlobalAllowed()
+  {
+    if (!globalAllowed())
+      mooseError("The static MooseRandom functions share one generator between all of the "
+                 "applications in the process and cannot be used while sub-apps are solved "
+                 "concurrently, set 'local_app_threads = 1'");
+  }
+
   /**
    * We store a pair of states in this map. The first one is the active state, the
    * second is the backup state. It is used to restore state at a later time
@@ -21,6 +21,7 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <mutex>
 #include <iterator>
 
 // Forward Declarations
@@ -158,6 +159,12 @@ std::string baseName(const std::string & name);
  */
 std::string hostname();
 
+/**
+ * The mutex that serializes the calls into the netCDF library (ExodusII and Nemesis files), which
+ * is not thread safe, between the main thread and the background writers
+ */
+std::mutex & netCDFMutex();
+
 /**
  * This routine is a simple helper function for searching a map by values instead of keys
  */
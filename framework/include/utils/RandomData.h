@@ -44,9 +44,33 @@ public:
    */
   unsigned int getSeed(dof_id_type id);
 
+  /**
+   * Whether or not the numbers are computed by the counter-based generator (CounterRandom)
+   * instead of the MooseRandom generator
+   */
+  bool isCounterBased() const { return _counter_based; }
+
+  ///@{
+  /**
+   * Return the next number from the counter-based generator for the passed in elem/node id.
+   * @param id - dof object id, which must be local
+   */
+  uint32_t randl(dof_id_type id);
+  Real rand(dof_id_type id);
+  ///@}
+
 private:
   void updateGenerators();
 
+  /**
+   * Restarts the sequence of every local elem/node of the counter-based generator
+   * @param rebuild - whether or not the local elems/nodes must be collected again
+   */
+  void resetCounters(bool rebuild);
+
+  /// Returns the index of the next number for the passed in elem/node id and advances it
+  uint32_t nextIndex(dof_id_type id);
+
   template <typename T>
   void updateGeneratorHelper(T it, T end_it);
 
@@ -54,6 +78,7 @@ private:
   MooseMesh & _rd_mesh;
 
   MooseRandom _generator;
+  const bool _counter_based;
   bool _is_nodal;
   ExecFlagType _reset_on;
 
@@ -62,6 +87,12 @@ private:
   unsigned int _new_seed;
 
   std::unordered_map<dof_id_type, unsigned int> _seeds;
+
+  /// The time step used as the stream of the counter-based generator
+  unsigned int _current_step;
+
+  /// The index of the next number of each local elem/node for the counter-based generator
+  std::unordered_map<dof_id_type, uint32_t> _counters;
 };
 
 #endif // RANDOMDATA_H
@@ -68,6 +68,7 @@ public:
    *                Data Accessors                  *
    **************************************************/
   unsigned int getMasterSeed() const { return _master_seed; }
+  bool isCounterBased() const { return _counter_based; }
   bool isNodal() const { return _is_nodal; }
   ExecFlagType getResetOnTime() const { return _reset_on; }
 
@@ -81,6 +82,7 @@ private:
   const std::string _ri_name;
 
   unsigned int _master_seed;
+  const bool _counter_based;
   bool _is_nodal;
   ExecFlagType _reset_on;
 
@@ -0,0 +1,129 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SHAREDDATASTORE_H
+#define SHAREDDATASTORE_H
+
+#include "libmesh/parallel.h"
+
+// C++ includes
+#include <functional>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(LIBMESH_HAVE_MPI) && MPI_VERSION >= 3
+#define MOOSE_HAVE_MPI_SHARED_MEMORY
+#endif
+
+/**
+ * A read-only view of an array held by the SharedDataStore
+ */
+template <typename T>
+class SharedArray
+{
+public:
+  SharedArray(const T * data = nullptr, std::size_t size = 0) : _data(data), _size(size) {}
+
+  const T * data() const { return _data; }
+  std::size_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  const T & operator[](std::size_t i) const { return _data[i]; }
+
+  const T * begin() const { return _data; }
+  const T * end() const { return _data + _size; }
+
+private:
+  const T * _data;
+  std::size_t _size;
+};
+
+/**
+ * Holds large, read-only data (lookup tables, images, ...) once per node instead of once per
+ * processor.
+ *
+ * The first time a named dataset is requested, it is loaded by a single processor on each node
+ * and copied into an MPI-3 shared memory window; all of the processors on the node then get a
+ * const view of that window. Without MPI-3, every processor loads and holds its own copy.
+ *
+ * Requesting a dataset that has not been loaded yet is collective: it must be done, in the same
+ * order, on all of the processors of the communicator. Later requests are local.
+ */
+class SharedDataStore
+{
+public:
+  SharedDataStore(const Parallel::Communicator & comm);
+  ~SharedDataStore();
+
+  SharedDataStore(const SharedDataStore &) = delete;
+  SharedDataStore & operator=(const SharedDataStore &) = delete;
+
+  /**
+   * Returns a view of the dataset \p name, loading it with \p load if it does not exist yet
+   * @param name The name of the dataset, e.g. the name of the file it is read from
+   * @param load Fills the vector with the dataset; only called on one processor per node
+   * @return The dataset, which stays valid for the life of the store
+   */
+  template <typename T>
+  SharedArray<T> get(const std::string & name,
+                     const std::function<void(std::vector<T> &)> & load);
+
+  /// Whether the datasets are shared by the processors of a node or held by each processor
+  static bool isShared();
+
+private:
+  struct Entry
+  {
+    const void * data = nullptr;
+    std::size_t size = 0;
+#ifdef MOOSE_HAVE_MPI_SHARED_MEMORY
+    MPI_Win window = MPI_WIN_NULL;
+#else
+    std::vector<char> local;
+#endif
+  };
+
+  /**
+   * Returns the address and the size in bytes of the dataset \p name, calling \p load to get the
+   * address and size of the data to be copied into the store if it does not exist yet
+   */
+  std::pair<const void *, std::size_t>
+  getBytes(const std::string & name,
+           const std::function<std::pair<const void *, std::size_t>()> & load);
+
+  const Parallel::Communicator & _communicator;
+
+#ifdef MOOSE_HAVE_MPI_SHARED_MEMORY
+  /// The processors that share memory with this one
+  MPI_Comm _node_comm;
+#endif
+
+  std::map<std::string, Entry> _entries;
+};
+
+template <typename T>
+SharedArray<T>
+SharedDataStore::get(const std::string & name, const std::function<void(std::vector<T> &)> & load)
+{
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Only trivially copyable types can be held by the SharedDataStore");
+
+  std::vector<T> data;
+  const auto bytes = getBytes(name, [&load, &data]() {
+    load(data);
+    return std::make_pair(static_cast<const void *>(data.data()), data.size() * sizeof(T));
+  });
+
+  return SharedArray<T>(static_cast<const T *>(bytes.first), bytes.second / sizeof(T));
+}
+
+#endif // SHAREDDATASTORE_H
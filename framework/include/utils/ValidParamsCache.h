@@ -0,0 +1,37 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef VALIDPARAMSCACHE_H
+#define VALIDPARAMSCACHE_H
+
+#include "InputParameters.h"
+
+namespace Moose
+{
+
+/**
+ * Returns a copy of the parameters built by a validParams function.
+ *
+ * The parameters of each function are built once per process and shared by every Factory and
+ * ActionFactory, so the MultiApps of an application do not rebuild the parameters of the same
+ * objects. The validParams functions must therefore not depend on the application that calls them,
+ * application specific parameters are added by the caller to the returned copy.
+ *
+ * @param params_func The validParams function of an object or action
+ */
+InputParameters cachedValidParams(InputParameters (*params_func)());
+
+/**
+ * The number of validParams functions with cached parameters
+ */
+std::size_t numCachedValidParams();
+
+} // namespace Moose
+
+#endif // VALIDPARAMSCACHE_H
@@ -55,6 +55,11 @@ public:
    */
   bool containsCompleteHistory() const { return _contains_complete_history; }
 
+  /**
+   * Return whether or not each processor holds a different part of the vectors
+   */
+  bool isDistributed() const { return _is_distributed; }
+
 protected:
   /**
    * Register a new vector to fill up.
@@ -76,6 +81,8 @@ private:
 
   const bool _is_broadcast;
 
+  const bool _is_distributed;
+
   std::map<std::string, VectorPostprocessorValue> _thread_local_vectors;
 };
 
@@ -49,6 +49,9 @@ public:
 
     /// Whether or not this vector needs to be scatterd
     bool needs_scatter = false;
+
+    /// Whether or not this vector was requested by an object that uses the complete vector
+    bool needs_complete = false;
   };
 
   /**
@@ -61,11 +64,14 @@ public:
    * history of the values
    * @param is_broadcast True if the vector will already be replicated by the VPP.  This prevents
    * unnecessary broadcasting by MOOSE.
+   * @param is_distributed True if each processor holds a different part of the vector, such
+   * vectors are never broadcast
    */
   VectorPostprocessorValue & declareVector(const std::string & vpp_name,
                                            const std::string & vector_name,
                                            bool contains_complete_history,
-                                           bool is_broadcast);
+                                           bool is_broadcast,
+                                           bool is_distributed = false);
 
   /**
    * Returns a true value if the VectorPostprocessor exists
@@ -125,6 +131,12 @@ public:
    */
   bool containsCompleteHistory(const std::string & name) const;
 
+  /**
+   * Returns a Boolean indicating whether each processor holds a different part of the specified VPP
+   * vectors.
+   */
+  bool isDistributed(const std::string & name) const;
+
   /**
    * Get the map of vectors for a particular VectorPostprocessor
    * @param vpp_name The name of the VectorPostprocessor
@@ -151,7 +163,8 @@ private:
                                                           bool contains_complete_history = false,
                                                           bool is_broadcast = false,
                                                           bool needs_broadcast = false,
-                                                          bool needs_scatter = false);
+                                                          bool needs_scatter = false,
+                                                          bool is_distributed = false);
   /**
    * Vector of pairs representing the declared vectors (vector name, vector DS)
    * The vector DS is a data structure containing a current and old container (vector of Reals)
@@ -174,6 +187,9 @@ private:
     /// Boolean indicating whether the vector will already be replicated in parallel by the VPP
     bool _is_broadcast;
 
+    /// Boolean indicating whether each processor holds a different part of the vectors
+    bool _is_distributed;
+
     /// Boolean indicating whether any old vectors have been requested.
     bool _needs_old;
   };
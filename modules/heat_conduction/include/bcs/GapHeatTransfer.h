@@ -29,6 +29,11 @@ public:
 
   virtual void initialSetup() override;
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeJacobianBlock(MooseVariableFEBase & jvar) override;
+  virtual void computeJacobianBlock(unsigned jvar) override;
+
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpJacobian() override;
@@ -39,6 +44,24 @@ protected:
   virtual Real computeSlaveFluxContribution(Real grad_t);
   virtual void computeGapValues();
 
+  /// Calls computeGapValues() once for each qp on the current side and stores the results
+  void cacheGapValues();
+
+  /// Restores the gap values stored by cacheGapValues() for the current qp
+  void loadGapValues();
+
+  /// The gap values computed by computeGapValues() for a single qp
+  struct GapValues
+  {
+    Real gap_temp;
+    Real gap_distance;
+    Real radius;
+    Real r1;
+    Real r2;
+    Real edge_multiplier;
+    bool has_info;
+  };
+
   GapConductance::GAP_GEOMETRY & _gap_geometry_type;
 
   const bool _quadrature;
@@ -75,6 +98,9 @@ protected:
 
   Point & _p1;
   Point & _p2;
+
+  /// Gap values for each qp on the current side, filled once per residual/Jacobian evaluation
+  std::vector<GapValues> _qp_gap_values;
 };
 
 #endif // GAPHEATTRANSFER_H
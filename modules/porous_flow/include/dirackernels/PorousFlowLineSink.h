@@ -13,6 +13,7 @@
 #include "PorousFlowLineGeometry.h"
 #include "PorousFlowSumQuantity.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeArray.h"
 
 class PorousFlowLineSink;
 
@@ -146,7 +147,7 @@ protected:
   const MaterialProperty<std::vector<std::vector<Real>>> * const _mass_fractions;
 
   /// d(Mass fraction of each component in each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> * const _dmass_fractions_dvar;
+  const MaterialProperty<PorousFlowDerivativeArray> * const _dmass_fractions_dvar;
 
   /// Enthalpy of each phase
   const MaterialProperty<std::vector<Real>> * const _enthalpy;
@@ -11,6 +11,7 @@
 #define POROUSFLOWADVECTIVEFLUX_H
 
 #include "PorousFlowDarcyBase.h"
+#include "PorousFlowDerivativeArray.h"
 
 class PorousFlowAdvectiveFlux;
 
@@ -35,7 +36,7 @@ protected:
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_fractions;
 
   /// Derivative of the mass fraction of each component in each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_fractions_dvar;
+  const MaterialProperty<PorousFlowDerivativeArray> & _dmass_fractions_dvar;
 
   /// Relative permeability of each phase
   const MaterialProperty<std::vector<Real>> & _relative_permeability;
@@ -13,6 +13,7 @@
 #include "Kernel.h"
 #include "PorousFlowDictator.h"
 #include "RankTwoTensor.h"
+#include "PorousFlowDerivativeArray.h"
 
 class PorousFlowDispersiveFlux;
 
@@ -54,7 +55,7 @@ protected:
   const MaterialProperty<std::vector<std::vector<RealGradient>>> & _grad_mass_frac;
 
   /// Derivative of mass fraction wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  const MaterialProperty<PorousFlowDerivativeArray> & _dmass_frac_dvar;
 
   /// Porosity at the qps
   const MaterialProperty<Real> & _porosity_qp;
@@ -72,7 +73,7 @@ protected:
   const MaterialProperty<std::vector<std::vector<Real>>> & _diffusion_coeff;
 
   /// Derivative of the diffusion coefficients wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _ddiffusion_coeff_dvar;
+  const MaterialProperty<PorousFlowDerivativeArray> & _ddiffusion_coeff_dvar;
 
   /// PorousFlowDictator UserObject
   const PorousFlowDictator & _dictator;
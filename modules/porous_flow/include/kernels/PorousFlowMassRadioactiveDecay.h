@@ -12,6 +12,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeArray.h"
 
 class PorousFlowMassRadioactiveDecay;
 
@@ -80,7 +81,7 @@ protected:
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
 
   /// d(nodal mass fraction)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  const MaterialProperty<PorousFlowDerivativeArray> & _dmass_frac_dvar;
 
   /**
    * Derivative of residual with respect to PorousFlow variable number pvar
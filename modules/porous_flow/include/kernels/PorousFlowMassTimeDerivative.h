@@ -12,6 +12,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeArray.h"
 
 class PorousFlowMassTimeDerivative;
 
@@ -89,7 +90,7 @@ protected:
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac_old;
 
   /// d(nodal mass fraction)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  const MaterialProperty<PorousFlowDerivativeArray> & _dmass_frac_dvar;
 
   /**
    * Derivative of residual with respect to PorousFlow variable number pvar
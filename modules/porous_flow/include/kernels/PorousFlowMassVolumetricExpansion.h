@@ -13,6 +13,7 @@
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
 #include "RankTwoTensor.h"
+#include "PorousFlowDerivativeArray.h"
 
 class PorousFlowMassVolumetricExpansion;
 
@@ -81,7 +82,7 @@ protected:
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
 
   /// d(mass fraction)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  const MaterialProperty<PorousFlowDerivativeArray> & _dmass_frac_dvar;
 
   /// Strain rate
   const MaterialProperty<Real> & _strain_rate_qp;
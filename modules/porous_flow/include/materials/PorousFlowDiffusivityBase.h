@@ -11,6 +11,7 @@
 #define POROUSFLOWDIFFUSIVITYBASE_H
 
 #include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowDerivativeArray.h"
 
 class PorousFlowDiffusivityBase;
 
@@ -36,7 +37,7 @@ protected:
   MaterialProperty<std::vector<std::vector<Real>>> & _diffusion_coeff;
 
   /// Derivative of the diffusion coefficients wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _ddiffusion_coeff_dvar;
+  MaterialProperty<PorousFlowDerivativeArray> & _ddiffusion_coeff_dvar;
 
   /// Input diffusion coefficients
   const std::vector<Real> _input_diffusion_coeff;
@@ -12,6 +12,7 @@
 
 #include "PorousFlowVariableBase.h"
 #include "PorousFlowFluidStateBase.h"
+#include "PorousFlowDerivativeArray.h"
 
 class PorousFlowFluidStateFlashBase;
 class PorousFlowCapillaryPressure;
@@ -105,7 +106,7 @@ protected:
   /// Gradient of the mass fraction matrix (only defined at the qps)
   MaterialProperty<std::vector<std::vector<RealGradient>>> * _grad_mass_frac_qp;
   /// Derivative of the mass fraction matrix with respect to the Porous Flow variables
-  MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  MaterialProperty<PorousFlowDerivativeArray> & _dmass_frac_dvar;
   /// Old value of saturation
   const MaterialProperty<std::vector<Real>> & _saturation_old;
 
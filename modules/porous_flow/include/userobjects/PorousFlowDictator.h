@@ -12,6 +12,7 @@
 
 #include "GeneralUserObject.h"
 #include "Coupleable.h"
+#include "PorousFlowDerivativeArray.h"
 
 class PorousFlowDictator;
 
@@ -127,6 +128,13 @@ public:
    */
   bool notPorousFlowVariable(unsigned int moose_var_num) const;
 
+  /**
+   * Sizes derivs to hold the derivatives of a phase-and-component quantity with
+   * respect to all PorousFlow variables, and zeroes it
+   * @param derivs the derivative array to size
+   */
+  void sizeDerivatives(PorousFlowDerivativeArray & derivs) const;
+
 protected:
   /// Number of PorousFlow variables
   const unsigned int _num_variables;
@@ -0,0 +1,98 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef POROUSFLOWDERIVATIVEARRAY_H
+#define POROUSFLOWDERIVATIVEARRAY_H
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+#include "DataIO.h"
+
+#include <vector>
+
+/**
+ * Contiguous storage for derivatives of a phase-and-component quantity (such as the
+ * mass fractions) with respect to the PorousFlow variables.  The entries are stored with
+ * fixed strides in the order phase, component, variable, so the derivatives of one
+ * phase-component pair with respect to all PorousFlow variables are contiguous.
+ *
+ * This replaces std::vector<std::vector<std::vector<Real>>>, which needs
+ * 1 + P + P*C heap allocations per quadrature point and per stateful copy.
+ */
+class PorousFlowDerivativeArray
+{
+public:
+  PorousFlowDerivativeArray();
+
+  /**
+   * Size the array and set all entries to zero.  No memory is reallocated if the
+   * total number of entries does not grow.
+   * @param num_phases Number of fluid phases
+   * @param num_components Number of fluid components
+   * @param num_vars Number of PorousFlow variables
+   */
+  void resize(unsigned int num_phases, unsigned int num_components, unsigned int num_vars);
+
+  /// Set all entries to zero
+  void zero();
+
+  /// Derivative of the (ph, comp) entry with respect to PorousFlow variable var
+  Real & operator()(unsigned int ph, unsigned int comp, unsigned int var)
+  {
+    return _vals[index(ph, comp, var)];
+  }
+  Real operator()(unsigned int ph, unsigned int comp, unsigned int var) const
+  {
+    return _vals[index(ph, comp, var)];
+  }
+
+  /// Derivatives of the (ph, comp) entry with respect to all PorousFlow variables
+  const Real * derivatives(unsigned int ph, unsigned int comp) const
+  {
+    return &_vals[index(ph, comp, 0)];
+  }
+
+  unsigned int numPhases() const { return _num_phases; }
+  unsigned int numComponents() const { return _num_components; }
+  unsigned int numVariables() const { return _num_vars; }
+
+  /// Total number of entries
+  std::size_t size() const { return _vals.size(); }
+
+protected:
+  /// Flat index of the (ph, comp, var) entry
+  std::size_t index(unsigned int ph, unsigned int comp, unsigned int var) const
+  {
+    mooseAssert(ph < _num_phases, "PorousFlowDerivativeArray: phase index out of range");
+    mooseAssert(comp < _num_components, "PorousFlowDerivativeArray: component index out of range");
+    mooseAssert(var < _num_vars, "PorousFlowDerivativeArray: variable index out of range");
+    return (static_cast<std::size_t>(ph) * _num_components + comp) * _num_vars + var;
+  }
+
+  unsigned int _num_phases;
+  unsigned int _num_components;
+  unsigned int _num_vars;
+
+  /// The derivatives, stored as [phase][component][variable]
+  std::vector<Real> _vals;
+
+  template <class T>
+  friend void dataStore(std::ostream &, T &, void *);
+
+  template <class T>
+  friend void dataLoad(std::istream &, T &, void *);
+};
+
+template <>
+void dataStore(std::ostream & stream, PorousFlowDerivativeArray & v, void * context);
+
+template <>
+void dataLoad(std::istream & stream, PorousFlowDerivativeArray & v, void * context);
+
+#endif // POROUSFLOWDERIVATIVEARRAY_H
@@ -44,6 +44,12 @@ protected:
   virtual void initQpStatefulProperties() override;
   virtual void initialSetup() override;
 
+  /**
+   * When batch_element_update is set, screen all quadrature points of the element for
+   * elastic trial states before calling computeQpProperties at each quadrature point
+   */
+  virtual void computeProperties() override;
+
   virtual void computeQpStress() override;
 
   /**
@@ -89,6 +95,16 @@ protected:
                                         RankTwoTensor & elastic_strain_increment,
                                         RankTwoTensor & combined_inelastic_strain_increment);
 
+  /**
+   * Elastic fast path of the batched update: the trial stress at the current quadrature point
+   * is admissible for every inelastic model, so the models only propagate their stateful
+   * properties and updateState is never called
+   * @param elastic_strain_increment Set to _strain_increment[_qp]
+   * @param combined_inelastic_strain_increment Set to zero
+   */
+  virtual void updateQpStateElastic(RankTwoTensor & elastic_strain_increment,
+                                    RankTwoTensor & combined_inelastic_strain_increment);
+
   /**
    * Using _elasticity_tensor[_qp] and the consistent tangent operators,
    * _consistent_tangent_operator[...] computed by the inelastic models,
@@ -176,6 +192,20 @@ protected:
 
   /// is the elasticity tensor guaranteed to be isotropic?
   bool _is_elasticity_tensor_guaranteed_isotropic;
+
+  /// whether to screen the whole element for elastic quadrature points before the return mapping
+  const bool _batch_element_update;
+
+  ///@{ Per quadrature point data of the current element, used by the batched update
+  std::vector<RankTwoTensor> _batch_trial_stress;
+  std::vector<unsigned char> _batch_elastic;
+  ///@}
+
+  /// Sum of the internal iterations of all inelastic models at the current quadrature point
+  unsigned int _qp_model_iterations;
+
+  /// Internal iteration counts of the inelastic models (only declared for the batched update)
+  MaterialProperty<Real> * _inelastic_iterations;
 };
 
 #endif // COMPUTEMULTIPLEINELASTICSTRESS_H
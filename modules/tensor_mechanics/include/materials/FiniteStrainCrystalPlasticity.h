@@ -338,6 +338,11 @@ protected:
   std::vector<Real> _gss_tmp;
   std::vector<Real> _gss_tmp_old;
 
+  ///@{ Work space for the slip system resistance update, sized once to avoid allocations
+  std::vector<Real> _gss_prev;
+  std::vector<Real> _hb;
+  ///@}
+
   DenseVector<Real> _slip_sys_props;
 
   DenseMatrix<Real> _dgss_dsliprate;
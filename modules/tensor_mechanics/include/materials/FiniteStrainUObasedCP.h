@@ -198,6 +198,9 @@ protected:
   /// Local old state variable
   std::vector<std::vector<Real>> _state_vars_prev;
 
+  /// Derivative of the slip rates with respect to the resolved shear stress (work space)
+  std::vector<std::vector<Real>> _dslipdtau;
+
   /// Stress residual equation relative tolerance
   Real _rtol;
   /// Stress residual equation absolute tolerance
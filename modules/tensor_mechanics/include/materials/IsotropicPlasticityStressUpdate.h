@@ -46,6 +46,8 @@ protected:
 
   virtual void computeStressInitialize(const Real effective_trial_stress,
                                        const RankFourTensor & elasticity_tensor) override;
+  virtual bool isElasticEffectiveTrialStress(const Real effective_trial_stress,
+                                             const RankFourTensor & elasticity_tensor) override;
   virtual Real computeResidual(const Real effective_trial_stress, const Real scalar) override;
   virtual Real computeDerivative(const Real effective_trial_stress, const Real scalar) override;
   virtual void iterationFinalize(Real scalar) override;
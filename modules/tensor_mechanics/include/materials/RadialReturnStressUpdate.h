@@ -81,6 +81,11 @@ public:
    */
   bool requiresIsotropicTensor() override { return true; }
 
+  virtual bool isElasticTrialState(const RankTwoTensor & trial_stress,
+                                   const RankFourTensor & elasticity_tensor) override;
+
+  virtual unsigned int qpIterationCount() const override { return _qp_iterations; }
+
 protected:
   virtual void initQpStatefulProperties() override;
 
@@ -104,6 +109,19 @@ protected:
   {
   }
 
+  /**
+   * Check whether the effective trial stress lies within the admissible region of the model, so
+   * that the return mapping would yield a zero inelastic strain increment.  Called from
+   * isElasticTrialState after _three_shear_modulus has been set.
+   * @param effective_trial_stress Effective trial stress
+   * @param elasticity_tensor      Elasticity tensor
+   */
+  virtual bool isElasticEffectiveTrialStress(const Real /*effective_trial_stress*/,
+                                             const RankFourTensor & /*elasticity_tensor*/)
+  {
+    return false;
+  }
+
   /**
    * Calculate the derivative of the strain increment with respect to the updated stress.
    * @param effective_trial_stress Effective trial stress
@@ -130,6 +148,9 @@ protected:
   const MaterialProperty<Real> & _effective_inelastic_strain_old;
   Real _max_inelastic_increment;
 
+  /// Number of return mapping iterations used at the current quadrature point
+  unsigned int _qp_iterations;
+
   /**
    * Rank two identity tensor
    */
@@ -33,6 +33,9 @@ public:
   void setRelativeTolerance(Real relative_tolerance) { _relative_tolerance = relative_tolerance; }
   void setAbsoluteTolerance(Real absolute_tolerance) { _absolute_tolerance = absolute_tolerance; }
 
+  /// Number of iterations taken by the most recent return mapping solve
+  unsigned int iterationCount() const { return _iteration; }
+
 protected:
   /**
    * Perform the return mapping iterations
@@ -107,6 +107,27 @@ public:
 
   virtual Real computeTimeStepLimit();
 
+  /**
+   * Check whether the trial stress at the current quadrature point is admissible for this model,
+   * i.e. whether updateState would return it unchanged together with a zero inelastic strain
+   * increment.  ComputeMultipleInelasticStress uses this to skip updateState for elastic
+   * quadrature points and call propagateQpStatefulProperties instead.  The default
+   * implementation conservatively returns false.
+   * @param trial_stress The stress obtained by applying the full strain increment elastically
+   * @param elasticity_tensor The elasticity tensor
+   */
+  virtual bool isElasticTrialState(const RankTwoTensor & /*trial_stress*/,
+                                   const RankFourTensor & /*elasticity_tensor*/)
+  {
+    return false;
+  }
+
+  /**
+   * Number of internal iterations used by the most recent updateState call at the current
+   * quadrature point.  Used for diagnostic output only.
+   */
+  virtual unsigned int qpIterationCount() const { return 0; }
+
   virtual TangentCalculationMethod getTangentCalculationMethod()
   {
     return TangentCalculationMethod::ELASTIC;
@@ -157,6 +157,7 @@ class TestHarness:
             checks['asio'] =  set(['ALL'])
             checks['boost'] = set(['ALL'])
             checks['fparser_jit'] = set(['ALL'])
+            checks['petsc_threadsafety'] = set(['ALL'])
         else:
             checks['compiler'] = util.getCompilers(self.libmesh_dir)
             checks['petsc_version'] = util.getPetscVersion(self.libmesh_dir)
@@ -183,6 +184,7 @@ class TestHarness:
             checks['asio'] =  util.getIfAsioExists(self.moose_dir)
             checks['boost'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'boost')
             checks['fparser_jit'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'fparser_jit')
+            checks['petsc_threadsafety'] = util.getPetscThreadSafety()
 
         # Override the MESH_MODE option if using the '--distributed-mesh'
         # or (deprecated) '--parallel-mesh' option.
@@ -518,6 +518,31 @@ def getIfAsioExists(moose_dir):
         option_set.add('FALSE')
     return option_set
 
+def getPetscThreadSafety():
+    # PETSc is only thread safe when configured with --with-threadsafety, which libMesh does not
+    # record, so it is read from the configuration of the PETSc pointed to by PETSC_DIR
+    option_set = set(['ALL'])
+    petsc_dir = os.environ.get('PETSC_DIR')
+    if petsc_dir is None:
+        return option_set
+
+    filenames = [
+      os.path.join(petsc_dir, os.environ.get('PETSC_ARCH', ''), 'include', 'petscconf.h'),
+      os.path.join(petsc_dir, 'include', 'petscconf.h')
+      ]
+
+    for filename in filenames:
+        if os.path.exists(filename):
+            with open(filename) as f:
+                contents = f.read()
+            if re.search(r'#define\s+PETSC_HAVE_THREADSAFETY\s+1', contents):
+                option_set.add('TRUE')
+            else:
+                option_set.add('FALSE')
+            break
+
+    return option_set
+
 def getLibMeshConfigOption(libmesh_dir, option):
     # Some tests work differently with parallel mesh enabled
     # We need to detect this condition
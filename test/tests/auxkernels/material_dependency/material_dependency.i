@@ -0,0 +1,82 @@
+# The nodal AuxKernel writes v, and the material used by the elemental AuxKernel couples to v in
+# the same aux sweep. The material must see the values of the current timestep, so the aux
+# solution has to be updated between the nodal and the elemental AuxKernels.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./v]
+  [../]
+  [./prop]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./t_func]
+    type = ParsedFunction
+    value = t
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./v_aux]
+    type = FunctionAux
+    variable = v
+    function = t_func
+    execute_on = 'initial timestep_end'
+  [../]
+  [./prop_aux]
+    type = MaterialRealAux
+    variable = prop
+    property = diffusion
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Materials]
+  [./coupled]
+    type = VarCouplingMaterial
+    var = v
+  [../]
+[]
+
+[Postprocessors]
+  [./prop_average]
+    type = ElementAverageValue
+    variable = prop
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 3
+[]
+
+[Outputs]
+  csv = true
+[]
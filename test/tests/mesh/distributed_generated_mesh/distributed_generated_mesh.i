@@ -50,6 +50,26 @@
   []
 []
 
+[Postprocessors]
+  [num_elems]
+    type = NumElems
+    execute_on = 'initial timestep_end'
+  []
+  [num_nodes]
+    type = NumNodes
+    execute_on = 'initial timestep_end'
+  []
+  [volume]
+    type = VolumePostprocessor
+    execute_on = 'initial timestep_end'
+  []
+  [right_area]
+    type = AreaPostprocessor
+    boundary = 'right'
+    execute_on = 'initial timestep_end'
+  []
+[]
+
 [Problem]
   solve = false
   type = FEProblem
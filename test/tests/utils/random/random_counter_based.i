@@ -0,0 +1,87 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./random_nodal]
+  [../]
+  [./random_elemental]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = CoefDiffusion
+    variable = u
+    coef = 0.1
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./random_nodal]
+    type = RandomAux
+    variable = random_nodal
+    random_generator = counter_based
+    execute_on = 'TIMESTEP_END'
+  [../]
+  [./random_elemental]
+    type = RandomAux
+    variable = random_elemental
+    generate_integers = true
+    random_generator = counter_based
+    execute_on = 'TIMESTEP_END'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./nodal_sum]
+    type = NodalSum
+    variable = random_nodal
+  [../]
+  [./elemental_average]
+    type = ElementAverageValue
+    variable = random_elemental
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]